@@ -61,14 +61,20 @@ SOURCES      := AS_global.C \
                 \
                 stores/sqLibrary.C \
                 stores/sqStore.C \
+                stores/sqStoreBlobReader.C \
+                stores/sqStoreBlobWriter.C \
                 stores/sqStoreConstructor.C \
                 stores/sqStoreInfo.C \
                 stores/sqStoreEncode.C \
                 stores/sqStorePartition.C \
+                stores/sqStoreReadLoader.C \
                 \
                 stores/ovOverlap.C \
                 stores/ovStore.C \
+                stores/ovStoreCursor.C \
+                stores/ovStoreIndex.C \
                 stores/ovStoreWriter.C \
+                stores/ovStoreSort.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
@@ -145,6 +151,7 @@ SRC_INCDIRS  := . \
 
 SUBMAKEFILES := stores/dumpBlob.mk \
                 stores/ovStoreBuild.mk \
+                stores/ovStoreStream.mk \
                 stores/ovStoreConfig.mk \
                 stores/ovStoreBucketizer.mk \
                 stores/ovStoreSorter.mk \
@@ -218,5 +225,8 @@ SUBMAKEFILES := stores/dumpBlob.mk \
 
 ifeq ($(BUILDTESTS), 1)
 SUBMAKEFILES += utility/bitsTest.mk \
-                utility/filesTest.mk
+                utility/filesTest.mk \
+                stores/sqStoreEncodeTest.mk \
+                stores/ovStoreBenchmark.mk \
+                overlapInCore/hashBucketBenchmark.mk
 endif
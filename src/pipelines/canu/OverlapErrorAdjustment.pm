@@ -721,6 +721,7 @@ sub updateOverlapStore ($) {
     $cmd .= "  -S ../../$asm.seqStore \\\n";
     $cmd .= "  -O ../$asm.ovlStore \\\n";
     $cmd .= "  -L ./oea.files \\\n";
+    $cmd .= "  -threads " . getGlobal("ovsThreads") . " \\\n";
     $cmd .= "> ./oea.apply.err 2>&1";
 
     if (runCommand($path, $cmd)) {
@@ -164,6 +164,7 @@ sub createOverlapStoreSequential ($$$) {
         print F " -O  ./$asm.ovlStore.BUILDING \\\n";
         print F" -S ../$asm.seqStore \\\n";
         print F " -C  ./$asm.ovlStore.config \\\n";
+        print F " -threads " . getGlobal("ovsThreads") . " \\\n";
         print F " > ./$asm.ovlStore.err 2>&1 \\\n";
         print F "&& \\\n";
         print F "mv ./$asm.ovlStore.BUILDING ./$asm.ovlStore\n";
@@ -307,6 +308,7 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -S ../$asm.seqStore \\\n";
         print F "  -C  ./$asm.ovlStore.config \\\n";
         print F "  -f \\\n";
+        print F "  -threads " . getGlobal("ovbThreads") . " \\\n";
         print F "  -b \$jobid \n";
         print F "\n";
 
@@ -383,7 +385,8 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -C  ./$asm.ovlStore.config \\\n";
         print F "  -f \\\n";
         print F "  -s \$jobid \\\n";
-        print F "  -M $sortMemory \n";
+        print F "  -M $sortMemory \\\n";
+        print F "  -threads " . getGlobal("ovsThreads") . "\n";
         print F "\n";
 
         if (defined(getGlobal("objectStore"))) {
@@ -839,6 +842,7 @@ sub createOverlapStore ($$) {
         $cmd .= "  -S ../$asm.seqStore \\\n";
         $cmd .= "  -C  ./$asm.ovlStore.config \\\n";
         $cmd .= "  -delete \\\n";
+        $cmd .= "  -threads " . getGlobal("ovsThreads") . " \\\n";
         $cmd .= "> ./$asm.ovlStore.BUILDING.index.err 2>&1";
 
         if (runCommand("$base", $cmd)) {